@@ -9,12 +9,30 @@
  */
 
 #include "softloq-json/element.hpp"
+#include "softloq-json/padded_string.hpp"
+#include <concepts>
+#include <cstddef>
+#include <ranges>
 
 namespace Softloq::JSON
 {
+    /** @brief Character or byte type that JSON text can be read from. */
+    template <class BYTE>
+    concept JSONByte = std::same_as<BYTE, char> || std::same_as<BYTE, unsigned char> || std::same_as<BYTE, char8_t> || std::same_as<BYTE, std::byte>;
+
+    /** @brief Contiguous range of JSON bytes, such as a std::span, std::vector or std::array. String types use the std::string_view overloads instead. */
+    template <class RANGE>
+    concept JSONByteRange = std::ranges::contiguous_range<RANGE> && std::ranges::sized_range<RANGE> && JSONByte<std::ranges::range_value_t<RANGE>> && !std::convertible_to<const RANGE &, std::string_view>;
+
+    /** @brief Views the JSON text held in a byte range without copying it. */
+    template <JSONByteRange RANGE>
+    inline const std::string_view toStringView(const RANGE &json_bytes) { return std::string_view(reinterpret_cast<const char *>(std::ranges::data(json_bytes)), std::ranges::size(json_bytes)); }
+
     /**
      * @brief Decoder converts JSON text into a modifiable object using several decode functions.
      * The error state of the decoder is based on the most recent decode function.
+     * JSON text can be given as anything convertible to std::string_view, as a JSONByteRange or as a PaddedString.
+     * No decode function copies its input.
      */
     class SOFTLOQ_JSON_API Decoder
     {
@@ -25,7 +43,14 @@ namespace Softloq::JSON
          * @param json_text The JSON text.
          * @return A pointer to the allocated JSON Element or nullptr on failure.
          */
-        const Element *decodeJSON(const std::string &json_text);
+        const Element *decodeJSON(const std::string_view json_text);
+
+        /** @brief Same as decodeJSON(), for JSON text held in a contiguous range of characters or bytes. */
+        template <JSONByteRange RANGE>
+        inline const Element *decodeJSON(const RANGE &json_bytes) { return decodeJSON(toStringView(json_bytes)); }
+
+        /** @brief Same as decodeJSON(), but strings are scanned in whole blocks that may read into the padding. */
+        const Element *decodeJSON(const PaddedString &json_text);
 
         /**
          * @brief Converts the entire JSON text into a modifiable C++ JSON Object object.
@@ -33,7 +58,14 @@ namespace Softloq::JSON
          * @param json_text The JSON text.
          * @return A pointer to the allocated JSON Object or nullptr on failure.
          */
-        const Object *decodeObject(const std::string &json_text);
+        const Object *decodeObject(const std::string_view json_text);
+
+        /** @brief Same as decodeObject(), for JSON text held in a contiguous range of characters or bytes. */
+        template <JSONByteRange RANGE>
+        inline const Object *decodeObject(const RANGE &json_bytes) { return decodeObject(toStringView(json_bytes)); }
+
+        /** @brief Same as decodeObject(), but strings are scanned in whole blocks that may read into the padding. */
+        const Object *decodeObject(const PaddedString &json_text);
 
         /**
          * @brief Converts the entire JSON text into a modifiable C++ JSON Array object.
@@ -41,7 +73,14 @@ namespace Softloq::JSON
          * @param json_text The JSON text.
          * @return A pointer to the allocated JSON Array or nullptr on failure.
          */
-        const Array *decodeArray(const std::string &json_text);
+        const Array *decodeArray(const std::string_view json_text);
+
+        /** @brief Same as decodeArray(), for JSON text held in a contiguous range of characters or bytes. */
+        template <JSONByteRange RANGE>
+        inline const Array *decodeArray(const RANGE &json_bytes) { return decodeArray(toStringView(json_bytes)); }
+
+        /** @brief Same as decodeArray(), but strings are scanned in whole blocks that may read into the padding. */
+        const Array *decodeArray(const PaddedString &json_text);
 
         /**
          * @brief Converts the entire JSON text into a modifiable C++ JSON String object.
@@ -49,7 +88,14 @@ namespace Softloq::JSON
          * @param json_text The JSON text.
          * @return A pointer to the allocated JSON String or nullptr on failure.
          */
-        const String *decodeString(const std::string &json_text);
+        const String *decodeString(const std::string_view json_text);
+
+        /** @brief Same as decodeString(), for JSON text held in a contiguous range of characters or bytes. */
+        template <JSONByteRange RANGE>
+        inline const String *decodeString(const RANGE &json_bytes) { return decodeString(toStringView(json_bytes)); }
+
+        /** @brief Same as decodeString(), but strings are scanned in whole blocks that may read into the padding. */
+        const String *decodeString(const PaddedString &json_text);
 
         /**
          * @brief Converts the entire JSON text into a modifiable C++ JSON Number object.
@@ -57,7 +103,14 @@ namespace Softloq::JSON
          * @param json_text The JSON text.
          * @return A pointer to the allocated JSON Number or nullptr on failure.
          */
-        const Number *decodeNumber(const std::string &json_text);
+        const Number *decodeNumber(const std::string_view json_text);
+
+        /** @brief Same as decodeNumber(), for JSON text held in a contiguous range of characters or bytes. */
+        template <JSONByteRange RANGE>
+        inline const Number *decodeNumber(const RANGE &json_bytes) { return decodeNumber(toStringView(json_bytes)); }
+
+        /** @brief Same as decodeNumber(), for JSON text held in a PaddedString. */
+        inline const Number *decodeNumber(const PaddedString &json_text) { return decodeNumber(json_text.view()); }
 
         /**
          * @brief Converts the entire JSON text into a modifiable C++ JSON Bool object.
@@ -65,7 +118,14 @@ namespace Softloq::JSON
          * @param json_text The JSON text.
          * @return A pointer to the allocated JSON Bool or nullptr on failure.
          */
-        const Bool *decodeBool(const std::string &json_text);
+        const Bool *decodeBool(const std::string_view json_text);
+
+        /** @brief Same as decodeBool(), for JSON text held in a contiguous range of characters or bytes. */
+        template <JSONByteRange RANGE>
+        inline const Bool *decodeBool(const RANGE &json_bytes) { return decodeBool(toStringView(json_bytes)); }
+
+        /** @brief Same as decodeBool(), for JSON text held in a PaddedString. */
+        inline const Bool *decodeBool(const PaddedString &json_text) { return decodeBool(json_text.view()); }
 
         /**
          * @brief Converts the entire JSON text into a modifiable C++ JSON Null object.
@@ -73,19 +133,30 @@ namespace Softloq::JSON
          * @param json_text The JSON text.
          * @return A pointer to the allocated JSON Null or nullptr on failure.
          */
-        const Null *decodeNull(const std::string &json_text);
+        const Null *decodeNull(const std::string_view json_text);
+
+        /** @brief Same as decodeNull(), for JSON text held in a contiguous range of characters or bytes. */
+        template <JSONByteRange RANGE>
+        inline const Null *decodeNull(const RANGE &json_bytes) { return decodeNull(toStringView(json_bytes)); }
+
+        /** @brief Same as decodeNull(), for JSON text held in a PaddedString. */
+        inline const Null *decodeNull(const PaddedString &json_text) { return decodeNull(json_text.view()); }
 
     private:
-        const bool parseValue(std::string_view &json_segment, std::unique_ptr<Element> &json_value);
-        const bool parseObject(std::string_view &json_segment, std::unique_ptr<Element> &json_object);
-        const bool parseMembers(std::string_view &json_segment, std::unique_ptr<Element> &json_object);
-        const bool parseMember(std::string_view &json_segment, std::unique_ptr<Element> &key, std::unique_ptr<Element> &json_value);
-        const bool parseArray(std::string_view &json_segment, std::unique_ptr<Element> &json_array);
-        const bool parseElements(std::string_view &json_segment, std::unique_ptr<Element> &json_array);
-        const bool parseElement(std::string_view &json_segment, std::unique_ptr<Element> &json_element);
-        const bool parseString(std::string_view &json_segment, std::unique_ptr<Element> &json_string);
-        const bool parseStringCharacters(std::string_view &json_segment, std::string &json_characters);
-        const bool parseStringEscape(std::string_view &json_segment, std::string &json_characters);
+        const Element *decodeJSON(const std::string_view json_text, const bool padded);
+        const Object *decodeObject(const std::string_view json_text, const bool padded);
+        const Array *decodeArray(const std::string_view json_text, const bool padded);
+        const String *decodeString(const std::string_view json_text, const bool padded);
+
+        const bool parseValue(std::string_view &json_segment, std::unique_ptr<Element> &json_value, const bool padded);
+        const bool parseObject(std::string_view &json_segment, std::unique_ptr<Element> &json_object, const bool padded);
+        const bool parseMembers(std::string_view &json_segment, std::unique_ptr<Element> &json_object, const bool padded);
+        const bool parseMember(std::string_view &json_segment, std::unique_ptr<Element> &key, std::unique_ptr<Element> &json_value, const bool padded);
+        const bool parseArray(std::string_view &json_segment, std::unique_ptr<Element> &json_array, const bool padded);
+        const bool parseElements(std::string_view &json_segment, std::unique_ptr<Element> &json_array, const bool padded);
+        const bool parseElement(std::string_view &json_segment, std::unique_ptr<Element> &json_element, const bool padded);
+        const bool parseString(std::string_view &json_segment, std::unique_ptr<Element> &json_string, const bool padded);
+        const bool parseStringCharacters(std::string_view &json_segment, std::string &json_characters, const bool padded);
         const bool parseNumber(std::string_view &json_segment, std::unique_ptr<Element> &json_number);
         const bool parseBool(std::string_view &json_segment, std::unique_ptr<Element> &json_bool);
         const bool parseNull(std::string_view &json_segment, std::unique_ptr<Element> &json_null);
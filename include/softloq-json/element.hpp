@@ -30,6 +30,8 @@ namespace Softloq::JSON
     class Element
     {
     public:
+        virtual ~Element() = default;
+
         /** @brief Get the Element Type of the JSON Element object. */
         virtual const ElementType getElementType() const = 0;
 
@@ -0,0 +1,48 @@
+#ifndef SOFTLOQ_JSON_PADDED_STRING_HPP
+#define SOFTLOQ_JSON_PADDED_STRING_HPP
+
+/**
+ * @author Brandon Foster
+ * @file padded_string.hpp
+ * @version 1.0.0
+ * @brief Contains the JSON Padded String Class.
+ */
+
+#include "softloq-json/macros.hpp"
+#include <memory>
+#include <string_view>
+
+namespace Softloq::JSON
+{
+    /**
+     * @brief JSON text followed by zeroed padding bytes, so the decoder can load whole blocks past the end of the text.
+     * The text can be written directly through data() to avoid copying it from another buffer.
+     */
+    class SOFTLOQ_JSON_API PaddedString
+    {
+    public:
+        /** @brief Number of readable bytes kept after the end of the text. */
+        static constexpr size_t padding = 64;
+
+        PaddedString();
+        explicit PaddedString(const size_t length);
+        explicit PaddedString(const std::string_view json_text);
+
+        /** @brief Moving leaves the other string empty, like a default constructed one. */
+        PaddedString(PaddedString &&other) noexcept;
+        PaddedString &operator=(PaddedString &&other) noexcept;
+
+        /** @brief Writable text, or nullptr for a default constructed or moved-from string, which owns no buffer. */
+        inline char *data() { return buffer.get(); }
+        /** @brief Text followed by the zeroed padding, never nullptr. */
+        const char *data() const;
+        inline const size_t length() const { return text_length; }
+        inline const std::string_view view() const { return std::string_view(data(), text_length); }
+
+    private:
+        std::unique_ptr<char[]> buffer;
+        size_t text_length;
+    };
+}
+
+#endif
\ No newline at end of file
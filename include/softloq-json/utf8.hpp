@@ -0,0 +1,43 @@
+#ifndef SOFTLOQ_JSON_UTF8_HPP
+#define SOFTLOQ_JSON_UTF8_HPP
+
+/**
+ * @author Brandon Foster
+ * @file utf8.hpp
+ * @version 1.0.0
+ * @brief Block-based UTF-8 validation and JSON string unescaping.
+ */
+
+#include "softloq-json/padded_string.hpp"
+#include <string>
+#include <string_view>
+
+namespace Softloq::JSON
+{
+    /**
+     * @brief Checks that the text is well-formed UTF-8 (no overlongs, surrogates or code points above U+10FFFF).
+     * On x86 CPUs with SSSE3, detected at run time, every 16 byte block is validated at once through nibble lookup tables.
+     * Otherwise ASCII runs are skipped a block at a time and multi-byte runs are checked against a lead byte table.
+     *
+     * @param text The text to validate.
+     * @return True if the entire text is valid UTF-8.
+     */
+    SOFTLOQ_JSON_API const bool validateUTF8(const std::string_view text);
+
+    /** @brief Same as validateUTF8(), but the last block is loaded from the padding instead of being copied out. */
+    SOFTLOQ_JSON_API const bool validateUTF8(const PaddedString &text);
+
+    /**
+     * @brief Decodes the characters of a JSON string up to, but not including, its closing quote.
+     * Unescaped runs are checked by the validateUTF8() kernel and copied in bulk.
+     * Escapes are decoded and \\u surrogate pairs are combined into one code point.
+     * On success the segment starts at the closing quote; on failure the segment and characters are left untouched.
+     *
+     * @param json_segment The JSON text following the opening quote.
+     * @param json_characters The decoded UTF-8 characters are appended here.
+     * @return True if the characters are valid and terminated by a closing quote.
+     */
+    SOFTLOQ_JSON_API const bool unescapeString(std::string_view &json_segment, std::string &json_characters);
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,35 @@
+#include "softloq-json/padded_string.hpp"
+#include <cstring>
+#include <utility>
+
+namespace Softloq::JSON
+{
+    namespace
+    {
+        /** @brief Read-only padding of every string that owns no buffer. */
+        const char empty_padding[PaddedString::padding] = {};
+    }
+
+    SOFTLOQ_JSON_API PaddedString::PaddedString() : buffer(), text_length(0) {}
+    SOFTLOQ_JSON_API PaddedString::PaddedString(const size_t length) : buffer(std::make_unique_for_overwrite<char[]>(length + padding)), text_length(length)
+    {
+        std::memset(buffer.get() + text_length, 0, padding);
+    }
+    SOFTLOQ_JSON_API PaddedString::PaddedString(const std::string_view json_text) : PaddedString(json_text.length())
+    {
+        if (!json_text.empty())
+            std::memcpy(buffer.get(), json_text.data(), json_text.length());
+    }
+    SOFTLOQ_JSON_API PaddedString::PaddedString(PaddedString &&other) noexcept : buffer(std::move(other.buffer)), text_length(std::exchange(other.text_length, 0)) {}
+    SOFTLOQ_JSON_API PaddedString &PaddedString::operator=(PaddedString &&other) noexcept
+    {
+        if (this != &other)
+        {
+            buffer = std::move(other.buffer);
+            text_length = std::exchange(other.text_length, 0);
+        }
+        return *this;
+    }
+
+    SOFTLOQ_JSON_API const char *PaddedString::data() const { return buffer ? buffer.get() : empty_padding; }
+}
\ No newline at end of file
@@ -0,0 +1,452 @@
+#include "softloq-json/utf8.hpp"
+#include "utf8_internal.hpp"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define SOFTLOQ_JSON_X86
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#define SOFTLOQ_JSON_TARGET_SSSE3
+#else
+#define SOFTLOQ_JSON_TARGET_SSSE3 __attribute__((target("ssse3")))
+#endif
+#endif
+
+namespace Softloq::JSON
+{
+    namespace
+    {
+        /** @brief Well-formed UTF-8 byte sequences by lead byte, see Table 3-7 of the Unicode Standard. */
+        struct LeadByte
+        {
+            uint8_t length; // 0 marks an invalid lead byte
+            uint8_t second_min;
+            uint8_t second_max;
+        };
+
+        constexpr std::array<LeadByte, 256> makeLeadByteTable()
+        {
+            std::array<LeadByte, 256> table{};
+            for (int byte = 0x00; byte <= 0x7F; ++byte)
+                table[byte] = {1, 0x00, 0x00};
+            for (int byte = 0xC2; byte <= 0xDF; ++byte)
+                table[byte] = {2, 0x80, 0xBF};
+            for (int byte = 0xE1; byte <= 0xEF; ++byte)
+                table[byte] = {3, 0x80, 0xBF};
+            for (int byte = 0xF1; byte <= 0xF3; ++byte)
+                table[byte] = {4, 0x80, 0xBF};
+            table[0xE0] = {3, 0xA0, 0xBF}; // no overlongs
+            table[0xED] = {3, 0x80, 0x9F}; // no surrogates
+            table[0xF0] = {4, 0x90, 0xBF}; // no overlongs
+            table[0xF4] = {4, 0x80, 0x8F}; // nothing above U+10FFFF
+            return table;
+        }
+        constexpr std::array<LeadByte, 256> lead_byte_table = makeLeadByteTable();
+
+        /** @brief Length of the UTF-8 sequence at the start of data, or 0 if it is malformed or truncated. */
+        const size_t sequenceLength(const unsigned char *data, const size_t length)
+        {
+            const LeadByte &lead = lead_byte_table[data[0]];
+            if (lead.length == 0 || lead.length > length)
+                return 0;
+            if (lead.length == 1)
+                return 1;
+            if (data[1] < lead.second_min || data[1] > lead.second_max)
+                return 0;
+            for (size_t i = 2; i < lead.length; ++i)
+                if ((data[i] & 0xC0) != 0x80)
+                    return 0;
+            return lead.length;
+        }
+
+        /** @brief Length of the run of valid multi-byte sequences at the start of data, or 0 if one is malformed or truncated. */
+        const size_t multiByteRunLength(const unsigned char *data, const size_t length)
+        {
+            size_t i = 0;
+            while (i < length && data[i] >= 0x80)
+            {
+                const size_t byte_count = sequenceLength(data + i, length - i);
+                if (byte_count == 0)
+                    return 0;
+                i += byte_count;
+            }
+            return i;
+        }
+
+#ifdef SOFTLOQ_JSON_X86
+        // Block validation after Keiser and Lemire, "Validating UTF-8 In Less Than One Instruction Per Byte".
+        // Every pair of adjacent bytes is classified by three 16 entry nibble tables whose intersection flags the error;
+        // missing or extra continuation bytes are found from the lead bytes two and three positions back.
+        constexpr uint8_t too_short = 1 << 0;      // 11______ 0_______ or 11______ 11______
+        constexpr uint8_t too_long = 1 << 1;       // 0_______ 10______
+        constexpr uint8_t overlong_3 = 1 << 2;     // 11100000 100_____
+        constexpr uint8_t too_large = 1 << 3;      // 11110100 1001____ and above
+        constexpr uint8_t surrogate = 1 << 4;      // 11101101 101_____
+        constexpr uint8_t overlong_2 = 1 << 5;     // 1100000_ 10______
+        constexpr uint8_t too_large_1000 = 1 << 6; // 11110101 1000____ and above
+        constexpr uint8_t overlong_4 = 1 << 6;     // 11110000 1000____
+        constexpr uint8_t two_conts = 1 << 7;      // 10______ 10______
+        constexpr uint8_t carry = too_short | too_long | two_conts;
+
+        SOFTLOQ_JSON_TARGET_SSSE3 inline __m128i highNibbles(const __m128i block) { return _mm_and_si128(_mm_srli_epi16(block, 4), _mm_set1_epi8(0x0F)); }
+
+        /** @brief Error bits of the 16 bytes of block, given the previous block. */
+        SOFTLOQ_JSON_TARGET_SSSE3 inline __m128i checkBlock(const __m128i block, const __m128i previous_block)
+        {
+            const __m128i byte_1_high_table = _mm_setr_epi8(
+                too_long, too_long, too_long, too_long, too_long, too_long, too_long, too_long,
+                two_conts, two_conts, two_conts, two_conts,
+                too_short | overlong_2,
+                too_short,
+                too_short | overlong_3 | surrogate,
+                too_short | too_large | too_large_1000 | overlong_4);
+            const __m128i byte_1_low_table = _mm_setr_epi8(
+                carry | overlong_3 | overlong_2 | overlong_4,
+                carry | overlong_2,
+                carry,
+                carry,
+                carry | too_large,
+                carry | too_large | too_large_1000,
+                carry | too_large | too_large_1000,
+                carry | too_large | too_large_1000,
+                carry | too_large | too_large_1000,
+                carry | too_large | too_large_1000,
+                carry | too_large | too_large_1000,
+                carry | too_large | too_large_1000,
+                carry | too_large | too_large_1000,
+                carry | too_large | too_large_1000 | surrogate,
+                carry | too_large | too_large_1000,
+                carry | too_large | too_large_1000);
+            const __m128i byte_2_high_table = _mm_setr_epi8(
+                too_short, too_short, too_short, too_short, too_short, too_short, too_short, too_short,
+                static_cast<char>(too_long | overlong_2 | two_conts | overlong_3 | too_large_1000 | overlong_4),
+                static_cast<char>(too_long | overlong_2 | two_conts | overlong_3 | too_large),
+                static_cast<char>(too_long | overlong_2 | two_conts | surrogate | too_large),
+                static_cast<char>(too_long | overlong_2 | two_conts | surrogate | too_large),
+                too_short, too_short, too_short, too_short);
+
+            const __m128i previous_1 = _mm_alignr_epi8(block, previous_block, 15);
+            const __m128i byte_1_high = _mm_shuffle_epi8(byte_1_high_table, highNibbles(previous_1));
+            const __m128i byte_1_low = _mm_shuffle_epi8(byte_1_low_table, _mm_and_si128(previous_1, _mm_set1_epi8(0x0F)));
+            const __m128i byte_2_high = _mm_shuffle_epi8(byte_2_high_table, highNibbles(block));
+            const __m128i special_cases = _mm_and_si128(_mm_and_si128(byte_1_high, byte_1_low), byte_2_high);
+
+            // bytes following a 3 or 4 byte lead must be continuations, which the pair tables flag as two_conts
+            const __m128i previous_2 = _mm_alignr_epi8(block, previous_block, 14);
+            const __m128i previous_3 = _mm_alignr_epi8(block, previous_block, 13);
+            const __m128i is_third_byte = _mm_subs_epu8(previous_2, _mm_set1_epi8(static_cast<char>(0xE0 - 0x80)));
+            const __m128i is_fourth_byte = _mm_subs_epu8(previous_3, _mm_set1_epi8(static_cast<char>(0xF0 - 0x80)));
+            const __m128i must_be_continuation = _mm_and_si128(_mm_or_si128(is_third_byte, is_fourth_byte), _mm_set1_epi8(static_cast<char>(0x80)));
+            return _mm_xor_si128(must_be_continuation, special_cases);
+        }
+
+        /** @brief Nonzero if block ends in the middle of a multi-byte sequence. */
+        SOFTLOQ_JSON_TARGET_SSSE3 inline __m128i incompleteBlock(const __m128i block)
+        {
+            const __m128i max_complete = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, static_cast<char>(0xF0 - 1), static_cast<char>(0xE0 - 1), static_cast<char>(0xC0 - 1));
+            return _mm_subs_epu8(block, max_complete);
+        }
+        /** @brief Block validator, the tail block is masked so padded data can be loaded past its length. */
+        SOFTLOQ_JSON_TARGET_SSSE3 const bool validateBlocks(const unsigned char *data, const size_t length, const bool padded)
+        {
+            __m128i error = _mm_setzero_si128();
+            __m128i previous_block = _mm_setzero_si128();
+            __m128i previous_incomplete = _mm_setzero_si128();
+            size_t i = 0;
+            for (; i + 16 <= length; i += 16)
+            {
+                const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i));
+                if (_mm_movemask_epi8(block) == 0)
+                    error = _mm_or_si128(error, previous_incomplete); // ASCII block, only a sequence cut off before it can fail
+                else
+                {
+                    error = _mm_or_si128(error, checkBlock(block, previous_block));
+                    previous_incomplete = incompleteBlock(block);
+                }
+                previous_block = block;
+            }
+
+            // the zero filled tail also completes the check of a sequence cut off at the end of the text
+            __m128i block;
+            if (padded)
+            {
+                static constexpr unsigned char tail_mask[32] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+                const __m128i mask = _mm_loadu_si128(reinterpret_cast<const __m128i *>(tail_mask + 16 - (length - i)));
+                block = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i)), mask);
+            }
+            else
+            {
+                alignas(16) unsigned char tail[16] = {};
+                if (i < length)
+                    std::memcpy(tail, data + i, length - i);
+                block = _mm_load_si128(reinterpret_cast<const __m128i *>(tail));
+            }
+            error = _mm_or_si128(error, checkBlock(block, previous_block));
+            return _mm_movemask_epi8(_mm_cmpeq_epi8(error, _mm_setzero_si128())) == 0xFFFF;
+        }
+
+        /** @brief Whether the CPU running the library supports SSSE3, checked once. */
+        const bool supportsSSSE3()
+        {
+#ifdef _MSC_VER
+            static const bool supported = []
+            {
+                int cpu_info[4];
+                __cpuid(cpu_info, 1);
+                return (cpu_info[2] & (1 << 9)) != 0;
+            }();
+#else
+            static const bool supported = []
+            {
+                __builtin_cpu_init();
+                return __builtin_cpu_supports("ssse3") != 0;
+            }();
+#endif
+            return supported;
+        }
+#endif
+
+        constexpr uint64_t broadcast(const uint8_t byte) { return 0x0101010101010101ull * byte; }
+
+        /** @brief Nonzero if any byte of the word is zero. */
+        constexpr uint64_t hasZeroByte(const uint64_t word) { return (word - broadcast(0x01)) & ~word & broadcast(0x80); }
+
+        /** @brief Number of leading ASCII bytes. Padded data may be loaded in whole blocks past its length. */
+        const size_t skipASCII(const unsigned char *data, const size_t length, const bool padded)
+        {
+            size_t i = 0;
+#ifdef __SSE2__
+            for (; padded ? i < length : i + 16 <= length; i += 16)
+            {
+                const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i));
+                const unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(block));
+                if (mask)
+                    return std::min(i + std::countr_zero(mask), length);
+            }
+#endif
+            for (; padded ? i < length : i + 8 <= length; i += 8)
+            {
+                uint64_t word;
+                std::memcpy(&word, data + i, 8);
+                if (word & broadcast(0x80))
+                    break;
+            }
+            while (i < length && data[i] < 0x80)
+                ++i;
+            return std::min(i, length);
+        }
+
+        /** @brief The UTF-8 validation kernel, block at a time when the CPU supports SSSE3, otherwise through the lead byte table. */
+        const bool isValidUTF8(const unsigned char *data, const size_t length, const bool padded)
+        {
+#ifdef SOFTLOQ_JSON_X86
+            if (supportsSSSE3())
+                return validateBlocks(data, length, padded);
+#endif
+            size_t i = 0;
+            while (i < length)
+            {
+                i += skipASCII(data + i, length - i, padded);
+                if (i == length)
+                    break;
+                const size_t byte_count = multiByteRunLength(data + i, length - i);
+                if (byte_count == 0)
+                    return false;
+                i += byte_count;
+            }
+            return true;
+        }
+
+        /** @brief Number of leading bytes before a '"', '\\' or control character. Sets non_ascii if a scanned block held a byte above 0x7F. */
+        const size_t skipPlain(const unsigned char *data, const size_t length, const bool padded, bool &non_ascii)
+        {
+            size_t i = 0;
+#ifdef __SSE2__
+            const __m128i quote = _mm_set1_epi8('"');
+            const __m128i backslash = _mm_set1_epi8('\\');
+            const __m128i control = _mm_set1_epi8(0x1F);
+            for (; padded ? i < length : i + 16 <= length; i += 16)
+            {
+                const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i));
+                const __m128i special = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(block, quote), _mm_cmpeq_epi8(block, backslash)), _mm_cmpeq_epi8(_mm_min_epu8(block, control), block));
+                non_ascii |= _mm_movemask_epi8(block) != 0;
+                const unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(special));
+                if (mask)
+                    return std::min(i + std::countr_zero(mask), length);
+            }
+#endif
+            for (; padded ? i < length : i + 8 <= length; i += 8)
+            {
+                uint64_t word;
+                std::memcpy(&word, data + i, 8);
+                const uint64_t special = hasZeroByte(word ^ broadcast('"')) | hasZeroByte(word ^ broadcast('\\')) | ((word - broadcast(0x20)) & ~word & broadcast(0x80));
+                if (special)
+                    break;
+                non_ascii |= (word & broadcast(0x80)) != 0;
+            }
+            for (; i < length && data[i] >= 0x20 && data[i] != '"' && data[i] != '\\'; ++i)
+                non_ascii |= data[i] >= 0x80;
+            return std::min(i, length);
+        }
+
+        /** @brief Parses the 4 hex digits of a \\u escape. */
+        const bool parseHex4(const unsigned char *data, const size_t length, char32_t &value)
+        {
+            if (length < 4)
+                return false;
+            value = 0;
+            for (size_t i = 0; i < 4; ++i)
+            {
+                value <<= 4;
+                if ('0' <= data[i] && data[i] <= '9')
+                    value |= data[i] - '0';
+                else if ('a' <= data[i] && data[i] <= 'f')
+                    value |= data[i] - 'a' + 10;
+                else if ('A' <= data[i] && data[i] <= 'F')
+                    value |= data[i] - 'A' + 10;
+                else
+                    return false;
+            }
+            return true;
+        }
+
+        void appendCodepoint(const char32_t codepoint, std::string &json_characters)
+        {
+            if (codepoint < 0x80)
+                json_characters += static_cast<char>(codepoint);
+            else if (codepoint < 0x800)
+            {
+                json_characters += static_cast<char>(0xC0 | (codepoint >> 6));
+                json_characters += static_cast<char>(0x80 | (codepoint & 0x3F));
+            }
+            else if (codepoint < 0x10000)
+            {
+                json_characters += static_cast<char>(0xE0 | (codepoint >> 12));
+                json_characters += static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+                json_characters += static_cast<char>(0x80 | (codepoint & 0x3F));
+            }
+            else
+            {
+                json_characters += static_cast<char>(0xF0 | (codepoint >> 18));
+                json_characters += static_cast<char>(0x80 | ((codepoint >> 12) & 0x3F));
+                json_characters += static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+                json_characters += static_cast<char>(0x80 | (codepoint & 0x3F));
+            }
+        }
+
+        /** @brief Decodes the escape following a backslash and returns the bytes consumed, or 0 if it is invalid. */
+        const size_t parseEscape(const unsigned char *data, const size_t length, std::string &json_characters)
+        {
+            if (length == 0)
+                return 0;
+
+            switch (data[0])
+            {
+            case '"':
+                json_characters += '"';
+                return 1;
+            case '\\':
+                json_characters += '\\';
+                return 1;
+            case '/':
+                json_characters += '/';
+                return 1;
+            case 'b':
+                json_characters += '\b';
+                return 1;
+            case 'f':
+                json_characters += '\f';
+                return 1;
+            case 'n':
+                json_characters += '\n';
+                return 1;
+            case 'r':
+                json_characters += '\r';
+                return 1;
+            case 't':
+                json_characters += '\t';
+                return 1;
+            case 'u':
+            {
+                char32_t codepoint;
+                if (!parseHex4(data + 1, length - 1, codepoint))
+                    return 0;
+                if (0xDC00 <= codepoint && codepoint <= 0xDFFF)
+                    return 0; // unpaired low surrogate
+                if (codepoint < 0xD800 || codepoint > 0xDBFF)
+                {
+                    appendCodepoint(codepoint, json_characters);
+                    return 5;
+                }
+
+                // high surrogate, must be followed by an escaped low surrogate
+                char32_t low_surrogate;
+                if (length < 11 || data[5] != '\\' || data[6] != 'u' || !parseHex4(data + 7, length - 7, low_surrogate))
+                    return 0;
+                if (low_surrogate < 0xDC00 || low_surrogate > 0xDFFF)
+                    return 0;
+                appendCodepoint(0x10000 + ((codepoint - 0xD800) << 10) + (low_surrogate - 0xDC00), json_characters);
+                return 11;
+            }
+            }
+
+            return 0;
+        }
+    }
+
+    SOFTLOQ_JSON_API const bool validateUTF8(const std::string_view text)
+    {
+        return isValidUTF8(reinterpret_cast<const unsigned char *>(text.data()), text.length(), false);
+    }
+    SOFTLOQ_JSON_API const bool validateUTF8(const PaddedString &text)
+    {
+        return isValidUTF8(reinterpret_cast<const unsigned char *>(text.data()), text.length(), true);
+    }
+    SOFTLOQ_JSON_API const bool unescapeString(std::string_view &json_segment, std::string &json_characters)
+    {
+        return Internal::unescapeString(json_segment, json_characters, false);
+    }
+
+    const bool Internal::unescapeString(std::string_view &json_segment, std::string &json_characters, const bool padded)
+    {
+        const unsigned char *data = reinterpret_cast<const unsigned char *>(json_segment.data());
+        const size_t length = json_segment.length();
+        const size_t base_length = json_characters.length();
+
+        size_t run_begin = 0;
+        size_t i = 0;
+        bool non_ascii = false;
+        while (i < length)
+        {
+            i += skipPlain(data + i, length - i, padded, non_ascii);
+            if (i == length || data[i] < 0x20)
+                break; // unterminated, or a control character that must be escaped
+
+            // the verbatim run is only validated if it holds multi-byte sequences
+            if (non_ascii && !isValidUTF8(data + run_begin, i - run_begin, padded))
+                break;
+            json_characters.append(json_segment.data() + run_begin, i - run_begin);
+            non_ascii = false;
+
+            if (data[i] == '"')
+            {
+                // ends the string of characters
+                json_segment = json_segment.substr(i);
+                return true;
+            }
+
+            const size_t byte_count = parseEscape(data + i + 1, length - i - 1, json_characters);
+            if (byte_count == 0)
+                break;
+            i += 1 + byte_count;
+            run_begin = i;
+        }
+
+        json_characters.resize(base_length);
+        return false;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,24 @@
+#ifndef SOFTLOQ_JSON_UTF8_INTERNAL_HPP
+#define SOFTLOQ_JSON_UTF8_INTERNAL_HPP
+
+/**
+ * @author Brandon Foster
+ * @file utf8_internal.hpp
+ * @version 1.0.0
+ * @brief Library internal variants of the UTF-8 functions.
+ */
+
+#include <string>
+#include <string_view>
+
+namespace Softloq::JSON::Internal
+{
+    /**
+     * @brief Same as Softloq::JSON::unescapeString(), optionally loading whole blocks past the end of the segment.
+     *
+     * @param padded Only true when the segment ends where the text of a PaddedString ends, so the padding is readable.
+     */
+    const bool unescapeString(std::string_view &json_segment, std::string &json_characters, const bool padded);
+}
+
+#endif
\ No newline at end of file
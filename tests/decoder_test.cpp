@@ -0,0 +1,88 @@
+#include "softloq-json/decoder.hpp"
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace Softloq::JSON;
+
+namespace
+{
+    int failures = 0;
+
+    void check(const bool condition, const char *description)
+    {
+        if (!condition)
+        {
+            std::printf("FAILED: %s\n", description);
+            ++failures;
+        }
+    }
+
+    /** @brief Decodes with the given decode function and compares the text form, where "" expects a failure. */
+    template <class DECODE>
+    void checkDecode(DECODE decode, const char *expected, const char *description)
+    {
+        const std::unique_ptr<const Element> json_element(decode());
+        check(json_element ? json_element->toString() == expected : *expected == '\0', description);
+    }
+}
+
+int main()
+{
+    Decoder decoder;
+    const std::string json_text = " [\"\\ud83d\\ude00\", \"caf\xC3\xA9\", true, null] ";
+    const char *expected = "[ \"\xF0\x9F\x98\x80\", \"caf\xC3\xA9\", true, null ]";
+
+    // every input type decodes the same text
+    checkDecode([&]
+                { return decoder.decodeJSON(json_text); }, expected, "std::string");
+    checkDecode([&]
+                { return decoder.decodeJSON(json_text.c_str()); }, expected, "C string");
+    checkDecode([&]
+                { return decoder.decodeArray(std::string_view(json_text)); }, expected, "std::string_view");
+    checkDecode([&]
+                { return decoder.decodeJSON(std::vector<char>(json_text.begin(), json_text.end())); }, expected, "std::vector<char>");
+    checkDecode([&]
+                { return decoder.decodeJSON(std::span<const char>(json_text)); }, expected, "std::span<const char>");
+    checkDecode([&]
+                { return decoder.decodeJSON(std::span<const std::uint8_t>(reinterpret_cast<const std::uint8_t *>(json_text.data()), json_text.size())); }, expected, "std::span<const std::uint8_t>");
+    checkDecode([&]
+                { return decoder.decodeJSON(std::as_bytes(std::span<const char>(json_text))); }, expected, "std::span<const std::byte>");
+    checkDecode([&]
+                { return decoder.decodeJSON(PaddedString(json_text)); }, expected, "PaddedString");
+    checkDecode([&]
+                { return decoder.decodeNull(PaddedString(std::string_view("null"))); }, "null", "decodeNull PaddedString");
+    checkDecode([&]
+                { return decoder.decodeBool(std::array<char, 4>{'t', 'r', 'u', 'e'}); }, "true", "decodeBool std::array");
+
+    // a byte range ending inside a longer buffer stops at its own end
+    checkDecode([&]
+                { return decoder.decodeString(std::span<const char>(json_text.data() + 2, 14)); }, "\"\xF0\x9F\x98\x80\"", "std::span inside a longer buffer");
+
+    // invalid text
+    checkDecode([&]
+                { return decoder.decodeJSON("[\"\\ud83d\"]"); }, "", "lone high surrogate");
+    checkDecode([&]
+                { return decoder.decodeJSON("[\"\xC0\xAF\"]"); }, "", "overlong");
+    checkDecode([&]
+                { return decoder.decodeJSON("[\"a\nb\"]"); }, "", "raw control character");
+    checkDecode([&]
+                { return decoder.decodeJSON("[1] x"); }, "", "trailing text");
+
+    // a moved-from PaddedString is an empty, still padded text
+    PaddedString padded_text(json_text);
+    PaddedString moved_text(std::move(padded_text));
+    check(padded_text.length() == 0 && padded_text.view().empty() && std::as_const(padded_text).data()[0] == '\0', "moved-from PaddedString is empty");
+    checkDecode([&]
+                { return decoder.decodeJSON(moved_text); }, expected, "moved-to PaddedString");
+    checkDecode([&]
+                { return decoder.decodeJSON(padded_text); }, "", "moved-from PaddedString");
+
+    if (failures == 0)
+        std::printf("All decoder tests passed.\n");
+    return failures == 0 ? 0 : 1;
+}
\ No newline at end of file
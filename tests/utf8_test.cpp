@@ -0,0 +1,91 @@
+#include "softloq-json/utf8.hpp"
+#include <cstdio>
+#include <string>
+
+using namespace Softloq::JSON;
+
+namespace
+{
+    int failures = 0;
+
+    void check(const bool condition, const char *description)
+    {
+        if (!condition)
+        {
+            std::printf("FAILED: %s\n", description);
+            ++failures;
+        }
+    }
+
+    /** @brief Unescapes the JSON string characters, which must be followed by a closing quote to succeed. */
+    const bool unescape(const std::string &json_text, std::string &json_characters)
+    {
+        std::string_view json_segment(json_text);
+        json_characters.clear();
+        if (!unescapeString(json_segment, json_characters))
+            return json_segment == json_text && json_characters.empty(); // failures leave both untouched
+        return json_segment == "\"";
+    }
+
+    const bool rejects(const std::string &json_text)
+    {
+        std::string json_characters;
+        std::string_view json_segment(json_text);
+        return !unescapeString(json_segment, json_characters) && json_segment == json_text && json_characters.empty();
+    }
+
+    const bool validates(const std::string &text)
+    {
+        const bool valid = validateUTF8(text);
+        check(valid == validateUTF8(PaddedString(text)), "padded and unpadded validation agree");
+        return valid;
+    }
+}
+
+int main()
+{
+    std::string json_characters;
+
+    // escapes
+    check(unescape("\\ud83d\\ude00\"", json_characters) && json_characters == "\xF0\x9F\x98\x80", "surrogate pair decodes to one emoji");
+    check(unescape("a\\\"b\\\\c\\/d\\b\\f\\n\\r\\t\\u00e9\\u20AC\"", json_characters) && json_characters == "a\"b\\c/d\b\f\n\r\t\xC3\xA9\xE2\x82\xAC", "simple escapes");
+    check(rejects("\\ud83d\""), "lone high surrogate");
+    check(rejects("\\ud83dx\\ude00\""), "high surrogate not directly followed by a low surrogate");
+    check(rejects("\\ud83d\\u0041\""), "high surrogate followed by a non-surrogate escape");
+    check(rejects("\\ude00\""), "lone low surrogate");
+    check(rejects("\\x\""), "unknown escape");
+    check(rejects("\\u12G4\""), "bad hex digit");
+
+    // raw characters
+    check(unescape("caf\xC3\xA9 \xE4\xB8\xAD\xE6\x96\x87 \xF0\x9F\x98\x80\"", json_characters) && json_characters == "caf\xC3\xA9 \xE4\xB8\xAD\xE6\x96\x87 \xF0\x9F\x98\x80", "raw multi-byte characters are copied");
+    for (char control = 0x00; control < 0x20; ++control)
+        check(rejects(std::string("abc") + control + "\""), "raw control character");
+    check(rejects(std::string(40, 'a') + '\n' + std::string(40, 'a') + "\""), "raw control character inside a long run");
+    check(rejects("\xC0\xAF\""), "overlong in a string");
+    check(rejects("no closing quote"), "unterminated string");
+
+    // validation
+    check(validates(""), "empty text");
+    check(validates("plain ascii text that spans more than one block"), "ascii");
+    check(validates("\xF0\x9F\x98\x80\xE4\xB8\xAD\xC3\xA9\xF4\x8F\xBF\xBF\xED\x9F\xBF"), "multi-byte characters");
+    check(!validates("\xC0\xAF"), "two byte overlong");
+    check(!validates("\xE0\x80\xAF"), "three byte overlong");
+    check(!validates("\xF0\x80\x80\xAF"), "four byte overlong");
+    check(!validates("\xED\xA0\x80"), "encoded surrogate");
+    check(!validates("\xF4\x90\x80\x80"), "above U+10FFFF");
+    check(!validates("\x80"), "stray continuation byte");
+    check(!validates("\xFF"), "invalid byte");
+    for (size_t prefix = 12; prefix <= 17; ++prefix)
+    {
+        const std::string emoji = std::string(prefix, 'a') + "\xF0\x9F\x98\x80";
+        check(validates(emoji + std::string(20, 'b')), "emoji across a 16 byte boundary");
+        check(!validates(emoji.substr(0, emoji.length() - 1)), "sequence cut off at the end");
+        check(!validates(emoji.substr(0, emoji.length() - 1) + std::string(20, 'b')), "sequence cut off by ascii");
+    }
+    check(!validates(std::string(15, 'a') + "\xE2\x82"), "sequence cut off at a 16 byte boundary");
+    check(!validates(std::string(15, 'a') + "\xE2" + std::string(16, 'b')), "sequence cut off before an ascii block");
+
+    if (failures == 0)
+        std::printf("All UTF-8 tests passed.\n");
+    return failures == 0 ? 0 : 1;
+}
\ No newline at end of file